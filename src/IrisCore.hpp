@@ -21,6 +21,8 @@
 
 #ifndef IrisCore_h
 #define IrisCore_h
+// DLPack (v1.0+) tensor structure (dlpack.h). Include dlpack.h to access its members.
+struct DLManagedTensorVersioned;
 namespace Iris {
 /**
  * @brief Get the major version of Iris within the binaries.
@@ -40,6 +42,12 @@ int     get_minor_version ();
  * @return int build number.
  */
 int     get_build_number  ();
+/**
+ * @brief Get the memory currently consumed by Iris within this process.
+ * 
+ * @param stats Iris::MemoryStats structure to populate
+ */
+Result  get_memory_stats  (MemoryStats& stats) noexcept;
 
 /**
  * @brief Create an Iris viewer instance.
@@ -51,9 +59,11 @@ int     get_build_number  ();
  * \note This function **only creates** the viewer.
  * **It does not initialize it.** The viewer must be bound to an application
  *  surface generated by the operating system before it can be used.
+ * \note String parameters used beyond this call (ex. ViewerCreateInfo::PipelineCachePath,
+ * written when the viewer is destroyed) are copied by the viewer.
  *
  * @return Valid Viewer handle on success
- * @return Nullptr on failure
+ * @return Nullptr on failure (ex. ViewerCreateInfo::DecodeThreadsMin exceeds a non-zero DecodeThreadsMax)
  */
 Viewer  create_viewer                   (const ViewerCreateInfo&) noexcept;
 
@@ -72,6 +82,18 @@ Viewer  create_viewer                   (const ViewerCreateInfo&) noexcept;
 Result  viewer_bind_external_surface    (const ViewerBindExternalSurfaceInfo&) noexcept;
 
 
+/**
+ * @brief Bind a viewer to an offscreen render target owned by the engine.
+ * 
+ * This initializes the viewer without an operating system draw surface. Frames
+ * are rendered at the requested size and may be retrieved with viewer_capture_frame.
+ * Unbind the target with viewer_unbind_surface (const Viewer&).
+ *
+ * @return IRIS_SUCCESS when the system has sucessfully configured
+ * @return IRIS_FAILURE when the system failed to effectively configure.
+ */
+Result  viewer_bind_offscreen_target    (const ViewerBindOffscreenInfo&) noexcept;
+
 /**
  * @brief Unbind the external drawing surface controlled by the calling application.
  * 
@@ -136,6 +158,37 @@ Result viewer_engine_zoom               (const Viewer& viewer, const ViewerZoomS
  */
 Result viewer_annotate_slide            (const Viewer& viewer, const SlideAnnotation&) noexcept;
 
+/**
+ * @brief Asynchronously capture the next presented frame.
+ * 
+ * This call returns immediately. The copy is recorded into the captured frame's
+ * own command submission: once the frame has been rendered, and before the image
+ * is transitioned for presentation, it is copied into a host visible readback
+ * buffer. Nothing is ever read back from an image after it has been presented.
+ * When that submission's fence signals, the pixels are converted to the requested
+ * Format and the callback is invoked. The render loop never waits on the readback.
+ * 
+ * If the viewer is idle (no frame is pending), the request schedules a frame of
+ * the unchanged view, so the capture always completes and matches the most
+ * recently presented frame. This works on both a bound external surface and an
+ * offscreen target (see viewer_bind_offscreen_target).
+ * 
+ * @param viewer Iris::Viewer handle
+ * @param format pixel Format of the captured frame
+ * @param callback Iris::ViewerFrameCaptureCallback receiving the frame and its dimensions
+ * @return IRIS_SUCCESS if the capture was scheduled
+ * @return IRIS_FAILURE if the viewer is not bound, the format is FORMAT_UNDEFINED, or callback is empty
+ */
+Result viewer_capture_frame             (const Viewer& viewer, Format format, const ViewerFrameCaptureCallback& callback) noexcept;
+
+/**
+ * @brief Get the runtime statistics of the viewer rendering engine.
+ *
+ * @param viewer Iris::Viewer handle
+ * @param stats Iris::ViewerStats structure to populate
+ */
+Result viewer_get_stats                 (const Viewer& viewer, ViewerStats& stats) noexcept;
+
 //  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ //
 //     Iris Slide Image Handler                                             //
 //  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ //
@@ -151,6 +204,8 @@ Result viewer_annotate_slide            (const Viewer& viewer, const SlideAnnota
  * \note Iris::viewer_open_slide(const Viewer& viewer, const Slide&) is the
  * preferred method as it allows the Iris Render Engine to configure optional
  * performance parameters.
+ * \note String parameters used beyond this call (ex. SlideOpenInfo::synthesisSidecarPath)
+ * are copied by the slide.
  * 
  * @param info Iris::SlideOpenInfo structure
  * 
@@ -159,6 +214,210 @@ Result viewer_annotate_slide            (const Viewer& viewer, const SlideAnnota
  */
 Slide create_slide                      (const SlideOpenInfo& info);
 
+/**
+ * @brief Get the extent of a slide including the tile extent of each objective layer.
+ *
+ * @param slide Iris::Slide handle
+ * @param extent Iris::Extent structure to populate
+ */
+Result slide_get_extent                 (const Slide& slide, Extent& extent) noexcept;
+
+/**
+ * @brief Get the runtime statistics of a slide's tile cache.
+ *
+ * This call does not lock the cache and may be called from any thread.
+ *
+ * @param slide Iris::Slide handle
+ * @param stats Iris::SlideCacheStats structure to populate
+ */
+Result slide_get_cache_stats            (const Slide& slide, SlideCacheStats& stats) noexcept;
+
+/**
+ * @brief Assign minimum and maximum cache shares to the slide's objective layers.
+ *
+ * Layers without a quota (quotas shorter than Extent::layers) are unrestricted.
+ * Passing an empty array removes all quotas. Minimum shares are validated after
+ * clamping each to its layer's tile count, so keeping the two coarsest layers
+ * entirely resident ({1.f, 1.f} minimums) succeeds whenever those layers fit
+ * within SlideOpenInfo::capacity.
+ * \sa LayerCacheQuota
+ *
+ * @param slide Iris::Slide handle
+ * @param quotas per-layer quotas indexed as Extent::layers
+ * @return IRIS_SUCCESS on success
+ * @return IRIS_FAILURE if the clamped minimum reservations together exceed the cache
+ * capacity, a minimum exceeds its maximum, a share lies outside [0,1.f], or quotas
+ * holds more entries than Extent::layers
+ */
+Result slide_set_layer_quotas           (const Slide& slide, const LayerCacheQuotas& quotas) noexcept;
+
+/**
+ * @brief Pin a region of tiles (ex. an annotated region of interest) in the slide tile cache.
+ *
+ * The tiles are read in the background if not already cached and are never
+ * evicted until the returned handle is destroyed. Overlapping pins are
+ * reference counted per tile. A pin may exceed its layer's LayerCacheQuota::maximum;
+ * the layer's unpinned tiles are then evicted first (see LayerCacheQuota).
+ * Under CACHE_ADMISSION_FREQUENCY, pinned tiles bypass the probationary segment
+ * and the frequency sketch: they are inserted directly into the main cache, and a
+ * pinned tile already held in probation is promoted immediately.
+ *
+ * @param slide Iris::Slide handle
+ * @param info Iris::SlidePinInfo structure
+ * @return Valid Iris::TilePin handle on success
+ * @return Nullptr on failure (ex. the region exceeds the cache capacity not reserved by other layers' minimums)
+ */
+TilePin slide_pin_tiles                 (const Slide& slide, const SlidePinInfo& info) noexcept;
+
+/**
+ * @brief Get the process-unique identifier of an open slide.
+ *
+ * This is the slide field of every Iris::TileKey referring to the slide's tiles.
+ * Identifiers are reused once a slide is destroyed.
+ *
+ * @param slide Iris::Slide handle
+ * @return uint16_t slide identifier
+ */
+uint16_t slide_get_id                   (const Slide& slide) noexcept;
+
+/**
+ * @brief Get one shard of a slide layer's tile space for distributed batch processing.
+ *
+ * Each processing node can open the same slide and request only its own shard index.
+ * When balancing by SHARD_BALANCE_TISSUE_AREA, tissue is detected from the lowest
+ * power layer of the slide using a fixed threshold so that results do not depend
+ * on thread count, platform, or cache state.
+ * \sa SlideShardInfo
+ *
+ * @param slide Iris::Slide handle
+ * @param info Iris::SlideShardInfo structure
+ * @param shard Iris::SlideShard structure to populate
+ * @return IRIS_SUCCESS on success
+ * @return IRIS_FAILURE if shardCount is zero or the layer or shard index is out of range
+ */
+Result slide_get_shard                  (const Slide& slide, const SlideShardInfo& info, SlideShard& shard) noexcept;
+
+/**
+ * @brief Read a single decoded tile from an Iris::Slide.
+ *
+ * The tile is served from the slide tile cache when present and otherwise
+ * read and decoded on the calling thread. If the tile is already being read
+ * elsewhere (ex. for a viewer), the call waits on that read instead of
+ * reading the tile a second time. The returned buffer contains
+ * 256 x 256 pixels in the requested Format.
+ *
+ * Decoded tiles are cached as FORMAT_R8G8B8A8. The returned buffer is
+ * **zero-copy** (it is the cached tile itself) only when both
+ *  - SlideTileReadInfo::format is FORMAT_R8G8B8A8, and
+ *  - SlideTileReadInfo::hint is TILE_READ_DEFAULT.
+ *
+ * A shared buffer must not be written into, resized, or have its strength changed.
+ * In every other case the tile is converted or copied into a new buffer owned
+ * solely by the caller. TILE_READ_STREAMING tiles are never shared with the tile
+ * cache or the streaming ring, even when the tile was found in the cache.
+ * \sa Buffer_export_dlpack to pass the tile to a machine learning framework without a copy.
+ *
+ * @param slide Iris::Slide handle
+ * @param info Iris::SlideTileReadInfo structure
+ * @return Valid Iris::Buffer handle containing the tile pixel data on success
+ * @return Nullptr on failure
+ */
+Buffer read_slide_tile                  (const Slide& slide, const SlideTileReadInfo& info) noexcept;
+
+/**
+ * @brief Export a slide to a tiled pyramidal BigTIFF file or a DeepZoom (DZI) tile folder.
+ *
+ * This call blocks until the export completes. Stored compressed tiles are
+ * reused whenever the output encoding matches and the remaining tiles are
+ * re-encoded in parallel.
+ * \sa SlideExportInfo
+ *
+ * @param info Iris::SlideExportInfo structure
+ * @param results Iris::SlideExportResults populated with tile counts and throughput
+ * @return IRIS_SUCCESS on success
+ * @return IRIS_FAILURE if the output could not be created or a tile failed to encode
+ */
+Result export_slide                     (const SlideExportInfo& info, SlideExportResults& results) noexcept;
+
+/**
+ * @brief Rewrite a slide as an Iris Codec file with tiles stored in Hilbert or Morton order.
+ *
+ * Encoded tiles are copied without being decoded; only their storage order changes.
+ * Compare SlideCacheStats::readOperations for the same viewports before and after
+ * repacking to measure the effect.
+ * \sa SlideRepackInfo
+ *
+ * @param info Iris::SlideRepackInfo structure
+ * @return IRIS_SUCCESS on success
+ * @return IRIS_FAILURE if the order is TILE_ORDER_STORAGE or the output could not be written
+ */
+Result repack_slide                     (const SlideRepackInfo& info) noexcept;
+
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ //
+//     Iris Tile Server                                                     //
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ //
+
+/**
+ * @brief Create an Iris::TileServer and begin serving slide tiles over HTTP.
+ *
+ * The server listens on its own threads and continues serving until
+ * the last copy of the returned handle is destroyed.
+ * \sa TileServerCreateInfo
+ *
+ * @param info Iris::TileServerCreateInfo structure
+ * @return Valid Iris::TileServer handle on success
+ * @return Nullptr on failure (ex. the address could not be bound)
+ */
+TileServer create_tile_server           (const TileServerCreateInfo& info);
+
+/**
+ * @brief Get the runtime statistics of an Iris::TileServer.
+ *
+ * @param server Iris::TileServer handle
+ * @param stats Iris::TileServerStats structure to populate
+ */
+Result tile_server_get_stats            (const TileServer& server, TileServerStats& stats) noexcept;
+
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ //
+//     Iris Patch Sampler                                                   //
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ //
+
+/**
+ * @brief Create an Iris::PatchSampler engine that draws random patches
+ * from a list of slide files.
+ *
+ * The sampler immediately begins filling its internal queue on background
+ * read threads. Slides are opened lazily and no more than
+ * PatchSamplerCreateInfo::openSlidesLimit slides are held open at any time.
+ * The sampler keeps its own copy of every slide's LocalSlideOpenInfo::filePath
+ * or NetworkSlideOpenInfo::slideID string, so the caller's strings may be
+ * released once this call returns.
+ *
+ * @param info Iris::PatchSamplerCreateInfo structure
+ *
+ * @return Valid Iris::PatchSampler handle on success
+ * @return Nullptr on failure
+ */
+PatchSampler create_patch_sampler       (const PatchSamplerCreateInfo& info);
+
+/**
+ * @brief Drain up to count patches from the sampler queue into the patches array.
+ *
+ * This is the pull interface intended to be called from a data loader. The call
+ * blocks only if the queue is empty. Patches already present within the array
+ * are reused: if a Patch::data buffer is not referenced elsewhere and has
+ * sufficient capacity, the new patch is written into that buffer rather than
+ * allocating a new one. Passing the same Iris::Patches array on every call
+ * therefore avoids per-patch allocations.
+ *
+ * @param sampler Iris::PatchSampler handle
+ * @param patches array resized to the number of patches returned
+ * @param count maximum number of patches to return
+ * @return IRIS_SUCCESS when at least one patch was returned
+ * @return IRIS_FAILURE if the sampler could not produce patches (ex. no readable slides)
+ */
+Result patch_sampler_pull               (const PatchSampler& sampler, Patches& patches, uint32_t count) noexcept;
+
 //  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ //
 //      Data Buffer Wrapper                                                 //
 //  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ //
@@ -260,6 +519,34 @@ void*   Buffer_write_into_buffer    (const Buffer& buffer, size_t bytes);
  * @param bytes number of bytes copied out of the buffer handle
  */
 void    Buffer_get_data             (const Buffer& buffer, void*& data, size_t& bytes);
+/**
+ * @brief Export an image buffer as a DLPack tensor **without copying** the data.
+ *
+ * The returned versioned (DLPack 1.0) tensor is an 8-bit unsigned,
+ * height x width x channels (HWC) tensor on the CPU device, with channels
+ * derived from the given Format (3 for FORMAT_R8G8B8 / FORMAT_B8G8R8 and 4 for
+ * the alpha formats). The tensor borrows the buffer's data block and holds a
+ * reference to the Iris::Buffer, keeping the data alive until the consumer calls
+ * the tensor's deleter. This is the preferred way to hand decoded tiles and
+ * patches to machine learning frameworks as it avoids the copy made by Buffer_get_data.
+ *
+ * If the buffer is shared with a slide tile cache (see read_slide_tile), the
+ * tensor is flagged DLPACK_FLAG_BITMASK_READ_ONLY. Consumers that require a
+ * writable tensor must copy it; the cached tile is never exposed writable.
+ * Buffers owned solely by the caller (patches, converted tiles) are exported writable.
+ *
+ * \note The buffer must not be resized, written into, or switched to a weak
+ * reference while the tensor is alive as this may invalidate the data pointer.
+ * \note Channel order is not expressed within DLPack; BGR formats are exported as-is.
+ *
+ * @param buffer Iris::Buffer handle containing at least width * height * channels bytes
+ * @param width number of horizontal pixels in the image
+ * @param height number of vertical pixels in the image
+ * @param format pixel Format of the image data
+ * @return DLManagedTensorVersioned* that must be released by calling its deleter
+ * @return NULL-pointer in the event of failure (ex. insufficient buffer size or FORMAT_UNDEFINED)
+ */
+DLManagedTensorVersioned* Buffer_export_dlpack (const Buffer& buffer, uint32_t width, uint32_t height, Format format);
 /**
  * @brief Change the strength of an Iris Buffer.
  * 
@@ -77,6 +77,24 @@ using Buffer = std::shared_ptr<class __INTERNAL__Buffer>;
  * \note __INTERNAL__Viewer is an internally defined class and not externally exposed.
  */
 using Viewer = std::shared_ptr <class __INTERNAL__Viewer>;
+/**
+ * @brief Process-wide memory accounting for Iris.
+ *
+ * Internal pipeline stages (decoding, format conversion, downsampling and
+ * annotation decoding) allocate their temporaries from a per-thread scratch
+ * arena that is reset at the end of each job, rather than from the heap.
+ * Arenas grow to the largest job a thread has processed and are then reused.
+ */
+struct MemoryStats {
+    /// @brief Bytes of decoded tile data held in all slide tile caches
+    size_t              cacheBytes          = 0;
+    /// @brief Number of threads that own a scratch arena
+    uint32_t            scratchArenas       = 0;
+    /// @brief Bytes currently reserved by all scratch arenas
+    size_t              scratchBytes        = 0;
+    /// @brief Largest number of scratch bytes used by a single job on any thread
+    size_t              scratchHighWater    = 0;
+};
 /**
  * @brief Handle to Slide File and Slide Loading Routines (Slide Loader)
  * 
@@ -84,7 +102,140 @@ using Viewer = std::shared_ptr <class __INTERNAL__Viewer>;
  * routines to bring slide data into RAM with limited overhead
  */
 using Slide  = std::shared_ptr<class  __INTERNAL__Slide>;
+/**
+ * @brief Handle to a Patch Sampler Engine
+ *
+ * The patch sampler holds a bounded pool of open slides and produces
+ * randomly located patches from them for model training pipelines.
+ * It is created using Iris::create_patch_sampler(const PatchSamplerCreateInfo&)
+ * \sa PatchSamplerCreateInfo
+ */
+using PatchSampler = std::shared_ptr<class __INTERNAL__PatchSampler>;
+/**
+ * @brief Handle to a set of pinned slide tiles.
+ *
+ * Pinned tiles are loaded into the slide tile cache and are never evicted
+ * while at least one copy of the handle persists. They are released once the
+ * last copy is destroyed. It is created using
+ * Iris::slide_pin_tiles(const Slide&, const SlidePinInfo&)
+ * \sa SlidePinInfo
+ */
+using TilePin = std::shared_ptr<class __INTERNAL__TilePin>;
+/**
+ * @brief Handle to an embedded HTTP tile server.
+ *
+ * The tile server publishes a single Iris::Slide over HTTP using the IIIF Image
+ * and / or DeepZoom tile protocols. It is created using
+ * Iris::create_tile_server(const TileServerCreateInfo&) and stops listening
+ * once the last copy of the handle is destroyed.
+ * \sa TileServerCreateInfo
+ */
+using TileServer = std::shared_ptr<class __INTERNAL__TileServer>;
 
+/**
+ * @brief Policy used to order pending tile reads and decodes.
+ */
+enum TileScheduling {
+    /// @brief Tiles are read in the order in which they were requested
+    TILE_SCHEDULING_FIFO,
+    /// @brief Tiles are tagged with the frame deadline by which they are needed and
+    /// are read earliest-deadline-first. Tiles that can no longer make their
+    /// deadline are skipped in favour of the coarser layer tile covering the same
+    /// region, which is drawn in its place until the finer tile arrives.
+    TILE_SCHEDULING_DEADLINE,
+};
+/**
+ * @brief Method used by the viewer to determine which tiles to request.
+ */
+enum TileRequestMode {
+    /// @brief Tiles are computed from the view rectangle and zoom level
+    TILE_REQUEST_GEOMETRIC,
+    /**
+     * @brief The renderer writes a low resolution feedback buffer recording the
+     * (layer, tile) wanted by each screen region and exactly those tiles are
+     * requested. This remains exact under rotation, zoom animation and
+     * multi-slide layouts. Supported by both the GPU and CPU rendering backends.
+     *
+     * The recorded tile is the one selected by the sampling level of detail,
+     * before any substitution: it is not the coarser tile drawn in its place
+     * while the wanted tile is missing (see TILE_SCHEDULING_DEADLINE), nor the
+     * tile chosen after the ViewerStats::layerBias of adaptive quality is applied.
+     * Feedback therefore keeps requesting the full resolution tiles while a
+     * fallback is on screen.
+     *
+     * Feedback lags the frame that wrote it. Until a feedback buffer has been
+     * read back (the first frames after binding a surface or a slide), tiles are
+     * requested as in TILE_REQUEST_GEOMETRIC.
+     */
+    TILE_REQUEST_FEEDBACK,
+};
+/**
+ * @brief Relative priority of an Iris internal thread.
+ *
+ * This maps onto the platform's native mechanism: quality of service classes
+ * on Apple platforms, thread priorities on Windows, and the nice value on
+ * Linux (unless ThreadPolicy::nice is given explicitly).
+ */
+enum ThreadPriority {
+    /// @brief Leave the thread at the priority it inherited from the process
+    THREAD_PRIORITY_DEFAULT,
+    /// @brief Work that may be deferred indefinitely (ex. prefetching)
+    THREAD_PRIORITY_BACKGROUND,
+    /// @brief Work the user is not waiting on
+    THREAD_PRIORITY_LOW,
+    /// @brief Work the user is waiting on
+    THREAD_PRIORITY_HIGH,
+    /// @brief Work required to present the next frame
+    THREAD_PRIORITY_INTERACTIVE,
+};
+/**
+ * @brief Operating system scheduler class of an Iris internal thread.
+ *
+ * \note Scheduler classes other than the default are only applied on Linux.
+ * Real-time classes typically require elevated privileges; if the class cannot
+ * be applied the thread continues with the default class.
+ */
+enum ThreadScheduler {
+    /// @brief Default time-sharing scheduler (SCHED_OTHER)
+    THREAD_SCHEDULER_DEFAULT,
+    /// @brief Throughput oriented, non-interactive scheduler (SCHED_BATCH)
+    THREAD_SCHEDULER_BATCH,
+    /// @brief Run only when the CPU would otherwise be idle (SCHED_IDLE)
+    THREAD_SCHEDULER_IDLE,
+    /// @brief Real-time first-in first-out scheduler (SCHED_FIFO)
+    THREAD_SCHEDULER_FIFO,
+    /// @brief Real-time round robin scheduler (SCHED_RR)
+    THREAD_SCHEDULER_ROUND_ROBIN,
+};
+/**
+ * @brief Sentinel ThreadPolicy::nice value requesting the nice value be derived
+ * from ThreadPolicy::priority. Any value in [-20,19], including 0, is applied as given.
+ */
+enum : int8_t {
+    THREAD_NICE_FROM_PRIORITY   = -128,
+};
+/**
+ * @brief Scheduling policy applied to a group of Iris internal threads.
+ */
+struct ThreadPolicy {
+    /// @brief Relative thread priority
+    ThreadPriority      priority;
+    /// @brief Explicit nice value [-20,19] (Linux only). THREAD_NICE_FROM_PRIORITY derives the value from priority
+    int8_t              nice;
+    /// @brief Operating system scheduler class
+    ThreadScheduler     scheduler;
+    /// @brief Logical CPU indices the threads may run on. Empty allows any CPU
+    std::vector<uint32_t> cpus;
+
+    ThreadPolicy                    (ThreadPriority thread_priority = THREAD_PRIORITY_DEFAULT,
+                                     int8_t nice_value = THREAD_NICE_FROM_PRIORITY,
+                                     ThreadScheduler thread_scheduler = THREAD_SCHEDULER_DEFAULT,
+                                     const std::vector<uint32_t>& cpu_set = std::vector<uint32_t>()) :
+    priority    (thread_priority),
+    nice        (nice_value),
+    scheduler   (thread_scheduler),
+    cpus        (cpu_set) {}
+};
 /**
  * @brief Defines necesary runtime parameters for starting the Iris rendering engine.
  * 
@@ -102,6 +253,122 @@ struct ViewerCreateInfo {
     /// @brief provides the executable location. This is needed for runtime
     /// loading of application files such as UI markup files and shader code.
     const char*         ApplicationBundlePath;
+    // ~~~~~~~~~~~~~ OPTIONAL FEATURES ~~~~~~~~~~~~~~~ //
+    /// @brief Tile read scheduling policy
+    TileScheduling      Scheduling          = TILE_SCHEDULING_DEADLINE;
+    /// @brief Frame presentation interval in microseconds used to compute tile deadlines.
+    /// Zero will use the refresh interval of the bound surface's display, or
+    /// 16667 (60 Hz) for an offscreen target, which has no display.
+    uint32_t            FrameInterval       = 0;
+    /**
+     * @brief Thread policies of the Iris internal threads.
+     *
+     * Iris names its threads so they can be identified by external tools:
+     * "Iris Render", "Iris Read #", "Iris Decode #", and "Iris Pref #".
+     * Names never exceed 15 characters, the Linux thread name limit.
+     * Prefetch threads run speculative reads that no current frame depends on
+     * and default to background priority so they never compete with the
+     * render and read threads.
+     */
+    ThreadPolicy        RenderThreadPolicy  = {THREAD_PRIORITY_INTERACTIVE};
+    /// @brief Policy of the threads reading tiles for the current view
+    ThreadPolicy        ReadThreadPolicy    = {THREAD_PRIORITY_HIGH};
+    /// @brief Policy of the threads decoding tiles for the current view
+    ThreadPolicy        DecodeThreadPolicy  = {THREAD_PRIORITY_HIGH};
+    /// @brief Policy of the threads reading and decoding tiles ahead of the view
+    ThreadPolicy        PrefetchThreadPolicy = {THREAD_PRIORITY_BACKGROUND};
+    /**
+     * @brief Path of the persisted graphics pipeline cache file.
+     *
+     * Compiled pipelines are written to this file when the viewer is destroyed
+     * and reloaded on the next call to create_viewer. The cache is keyed by the
+     * GPU vendor, device, driver version, and Iris build; a stale or foreign
+     * cache file is ignored and rebuilt. The location must be writable (the
+     * application bundle frequently is not). Nullptr disables the persisted cache.
+     *
+     * The file is written to a uniquely named temporary file in the same
+     * directory and then atomically renamed over the path, so viewers in this
+     * or other processes that share the path never observe a partial file; the
+     * last viewer destroyed wins. The file header records the payload size and
+     * a hash of the payload, and both are checked before the payload is passed
+     * to the driver. A truncated or corrupted file is ignored and rebuilt.
+     * The path string is copied by create_viewer and need not outlive that call.
+     */
+    const char*         PipelineCachePath   = nullptr;
+    /// @brief Only compile the pipelines needed by the first frame during surface binding
+    /// and compile the remaining pipelines on a background thread.
+    bool                DeferPipelines      = true;
+    /**
+     * @brief Size in bytes of the persistently mapped tile upload staging ring.
+     *
+     * A decoded tile is owned by its slide tile cache entry: decoders write
+     * pixels once, into the buffer held by the cache, which is also the buffer
+     * shared with deduplicated requests and returned by read_slide_tile. Staging
+     * copies that buffer into a ring slot, which is the only CPU copy on the
+     * upload path, and all tiles staged during a frame are copied to GPU memory
+     * in one batched transfer submission rather than a submission per tile.
+     * Ring slots are released once their transfer completes. A tile whose
+     * slot is evicted from the GPU atlas is staged again from the tile cache
+     * without being decoded again, if it is still cached.
+     */
+    size_t              StagingRingSize     = 64ULL << 20;
+    /**
+     * @brief Maximum number of bytes uploaded to the GPU per frame.
+     *
+     * Tiles over budget remain staged and are uploaded in a following frame.
+     * At least one staged tile is always uploaded per frame, even if the budget is
+     * smaller than a single tile (256 KiB for RGBA), so uploads always make progress.
+     *
+     * If the staging ring is full of deferred tiles, decoders do not wait for space:
+     * the decoded tile is cached as usual and is copied into the ring once space
+     * is released. Staged tiles that are no longer visible are dropped
+     * from the ring before visible ones are deferred.
+     */
+    size_t              UploadBudget        = 16ULL << 20;
+    /**
+     * @brief Number of GPU resident tile slots.
+     *
+     * Resident tiles are packed into layered array textures through a slot
+     * allocator and an indirection table rather than allocated as one image
+     * per tile, allowing each slide layer to be drawn in a single draw call.
+     * This bounds GPU tile memory in the same way SlideOpenInfo::capacity bounds
+     * RAM; the least recently drawn tile slot is reused when the atlas is full.
+     *
+     * Each slot costs 256 KiB of GPU memory (256 x 256 RGBA pixels), so 1000 slots
+     * reserve 250 MiB. The default of 0 sizes the atlas when a slide is opened to
+     * match that slide's SlideOpenInfo::capacity (1000 slots / 250 MiB by default).
+     * Lower this on integrated or mobile GPUs with limited memory.
+     */
+    uint32_t            TileSlots           = 0;
+    /// @brief Method used to determine which tiles are requested
+    TileRequestMode     TileRequests        = TILE_REQUEST_FEEDBACK;
+    /// @brief Screen pixels per feedback buffer texel in each dimension (TILE_REQUEST_FEEDBACK)
+    uint32_t            FeedbackScale       = 16;
+    /**
+     * @brief Temporarily reduce drawn resolution when decoding falls behind.
+     *
+     * When the pending decode work exceeds what can complete within the frame
+     * budget, the engine draws one layer coarser and stops requesting the
+     * finest layer for regions in motion. Full resolution is restored once
+     * motion stops and the decode backlog drains.
+     */
+    bool                AdaptiveQuality     = true;
+    /**
+     * @brief Bounds of the decode thread pool.
+     *
+     * The pool grows toward the maximum while the decode queue is deep or
+     * tile latency exceeds the frame interval, provided the system load average
+     * leaves headroom, and shrinks back toward the minimum when idle. Setting
+     * both bounds to the same value gives a fixed size pool. A maximum of zero
+     * uses the available hardware concurrency, raised to DecodeThreadsMin if the
+     * minimum is larger. A minimum of zero is treated as one thread.
+     *
+     * \note create_viewer fails if DecodeThreadsMax is non-zero and smaller than
+     * DecodeThreadsMin.
+     */
+    uint32_t            DecodeThreadsMin    = 1;
+    /// @brief Maximum number of decode threads (see DecodeThreadsMin)
+    uint32_t            DecodeThreadsMax    = 0;
 };
 /**
  * @brief  System specific binding information to configure Iris' rendering engine
@@ -122,6 +389,21 @@ struct ViewerBindExternalSurfaceInfo {
     const void*         layer       = nullptr; 
 #endif
 };
+/**
+ * @brief Binding information to initialize Iris' rendering engine with an
+ * offscreen render target rather than an operating system draw surface.
+ *
+ * Offscreen viewers render into an engine owned image of the given size and
+ * are intended for headless rendering and frame capture.
+ * \sa viewer_capture_frame
+ */
+struct ViewerBindOffscreenInfo {
+    const Viewer        viewer      = nullptr;
+    /// @brief Number of horizontal pixels in the offscreen target
+    uint32_t            width       = 0;
+    /// @brief Number of vertical pixels in the offscreen target
+    uint32_t            height      = 0;
+};
 /**
  * @brief  Information to translate the rendered scope view as a fraction of the active
  * view space with direction given by the sign.
@@ -158,6 +440,60 @@ struct ViewerZoomScope {
     /// @brief Vertical location of zoom origin
     float               y_location  = 0.5f;
 };
+/**
+ * @brief Rendering quality state of a viewer (see ViewerCreateInfo::AdaptiveQuality)
+ */
+enum ViewerQuality {
+    /// @brief Tiles are requested and drawn at the layer matching the current zoom
+    VIEWER_QUALITY_FULL,
+    /// @brief The decode backlog exceeds the frame budget; regions in motion are drawn coarser
+    VIEWER_QUALITY_REDUCED,
+};
+/**
+ * @brief Runtime statistics of an Iris::Viewer rendering engine.
+ *
+ * Counters are cumulative from the creation of the viewer.
+ */
+struct ViewerStats {
+    /// @brief Number of frames presented to the bound surface
+    uint64_t            framesPresented = 0;
+    /// @brief Number of tiles that were completed after their frame deadline
+    uint64_t            tilesLate       = 0;
+    /// @brief Number of tile reads skipped because they could not make their deadline
+    uint64_t            tilesSkipped    = 0;
+    /// @brief Number of tile draws that used a coarser layer in place of a missing tile
+    uint64_t            tilesFallback   = 0;
+    /// @brief Number of graphics pipelines restored from the persisted pipeline cache
+    uint32_t            pipelinesCached = 0;
+    /// @brief Number of graphics pipelines compiled at runtime
+    uint32_t            pipelinesCompiled = 0;
+    /// @brief Number of tile bytes uploaded to the GPU
+    uint64_t            uploadBytes     = 0;
+    /// @brief Number of batched upload submissions
+    uint64_t            uploadSubmissions = 0;
+    /// @brief Number of tiles deferred to a later frame by the per-frame upload budget
+    uint64_t            uploadsDeferred = 0;
+    /// @brief Total number of GPU tile slots (see ViewerCreateInfo::TileSlots)
+    uint32_t            tileSlots       = 0;
+    /// @brief Number of GPU tile slots currently holding a tile
+    uint32_t            tileSlotsUsed   = 0;
+    /// @brief Number of resident tiles evicted from the atlas to free a slot
+    uint64_t            tileSlotEvictions = 0;
+    /// @brief Number of tiles requested after being sampled in the feedback buffer
+    uint64_t            feedbackRequests = 0;
+    /// @brief Current rendering quality state
+    ViewerQuality       quality         = VIEWER_QUALITY_FULL;
+    /// @brief Number of layers coarser than the zoom matched layer currently drawn in motion
+    uint32_t            layerBias       = 0;
+    /// @brief Number of tiles currently waiting to be decoded
+    uint32_t            decodeBacklog   = 0;
+    /// @brief Number of times quality has been reduced since viewer creation
+    uint64_t            qualityReductions = 0;
+    /// @brief Number of decode threads currently in the pool
+    uint32_t            decodeThreads   = 0;
+    /// @brief Recent average time in microseconds from tile request to decoded tile
+    uint32_t            tileLatency     = 0;
+};
 /**
  * @brief Defines the image encoding format for an image annotation.
  * 
@@ -211,6 +547,8 @@ struct LayerExtent {
     float               scale       = 1.f;
     /// @brief Reciprocal scale factor relative to the most zoomed level (for OpenSlide compatibility)
     float               downsample  = 1.f;
+    /// @brief This layer is not stored within the slide file and is generated from the next finer layer
+    bool                synthesized = false;
 };
 using LayerExtents = std::vector<LayerExtent>;
 /**
@@ -244,6 +582,65 @@ enum Format {
     /// @brief 8-bit red, 8-bit green, 8-bit blue, 8-bit alpha
     FORMAT_R8G8B8A8,
 };
+/**
+ * @brief A rendered frame returned by Iris::viewer_capture_frame
+ *
+ * The data buffer holds width x height pixels in the requested Format, tightly
+ * packed in rows from the top left corner. The dimensions are those of the
+ * rendered image in pixels; on HiDPI displays this is the drawable size of the
+ * surface, not its size in points.
+ */
+struct ViewerFrameCapture {
+    /// @brief Frame pixel data; nullptr if the capture failed
+    Buffer              data;
+    /// @brief Number of horizontal pixels in the frame
+    uint32_t            width       = 0;
+    /// @brief Number of vertical pixels in the frame
+    uint32_t            height      = 0;
+    /// @brief Pixel Format of the frame data
+    Format              format      = FORMAT_UNDEFINED;
+    /// @brief Index of the captured frame (see ViewerStats::framesPresented)
+    uint64_t            frame       = 0;
+};
+/**
+ * @brief Callback receiving the result of an asynchronous frame capture.
+ *
+ * It is invoked once, on an Iris internal thread, with IRIS_SUCCESS and the
+ * captured frame, or with IRIS_FAILURE (and an empty capture) if the viewer
+ * was unbound or destroyed before the capture completed.
+ *
+ * The callback is never invoked on the render thread; the readback is
+ * delivered on a capture worker thread, so a slow callback (ex. encoding or
+ * writing the frame to disk) does not stall rendering. Callbacks are invoked
+ * one at a time in capture order, so a callback that blocks delays the
+ * delivery of later captures.
+ */
+using ViewerFrameCaptureCallback = std::function<void(Result, const ViewerFrameCapture&)>;
+/**
+ * @brief Downsampling filter used to generate missing pyramid layers.
+ */
+enum LayerSynthesisFilter {
+    /// @brief 2x2 box average; fastest
+    LAYER_SYNTHESIS_BOX,
+    /// @brief Lanczos (a = 3) resampling; sharper at a higher decode cost
+    LAYER_SYNTHESIS_LANCZOS,
+};
+/**
+ * @brief Policy deciding whether a newly decoded tile enters the main tile cache.
+ */
+enum CacheAdmission {
+    /// @brief Every decoded tile is inserted into the main cache
+    CACHE_ADMISSION_ALWAYS,
+    /**
+     * @brief Tiles are first placed in a small probationary segment and are only
+     * promoted into the main cache if a frequency sketch (TinyLFU) estimates them
+     * to be used more often than the tile they would evict. Tiles requested while
+     * the view is panning faster than one view per second, or that are displayed
+     * for only a few frames, are not credited by the sketch. Fast flings therefore
+     * do not displace the working set.
+     */
+    CACHE_ADMISSION_FREQUENCY,
+};
 /**
  * @brief Information to open a slide file located on a local volume.
  * 
@@ -321,12 +718,642 @@ struct SlideOpenInfo {
      * Greater values cache more in-memory decompressed tile data
      * for greater performance. Less require more pulls from
      * disk (which is slower)
-     * The default 1000 for RGBA images consumes 2 GB of RAM.
+     * Each RGBA tile is 256 KiB (256 x 256 x 4 bytes), so the default
+     * 1000 tiles consume about 250 MiB of RAM.
      */
     size_t               capacity       = 1000;
+    /**
+     * @brief Expected number of threads concurrently accessing the slide tile cache
+     *
+     * The tile cache index is a striped concurrent hash table. Lookups
+     * are lock-free and never wait behind inserts from the read threads;
+     * inserts and evictions lock only the stripe holding the tile.
+     * This value sizes the number of stripes. The default of 0 uses
+     * the available hardware concurrency.
+     */
+    uint32_t             cacheConcurrency = 0;
+    /**
+     * @brief Partition the tile cache per NUMA node
+     *
+     * When enabled on a multi-socket system, each NUMA node holds its own
+     * partition of the tile cache and decode jobs are placed on the node of
+     * the thread that requested the tile, so that decoded tiles are consumed
+     * from local memory. Partitions are sized by demand rather than by an
+     * even split: capacity, layer quotas (see slide_set_layer_quotas) and
+     * pinned tiles are all accounted against the whole cache, and the least
+     * recently used tile is evicted from whichever partition holds it. A
+     * viewer whose threads run on one node may therefore use the full capacity
+     * on that node. ViewerCreateInfo::TileSlots sizing also uses the whole
+     * capacity.
+     * This has no effect on systems with a single NUMA node. It is disabled by
+     * default because a single interactive viewer rarely spans sockets.
+     */
+    bool                 numaPartitioned = false;
+    /**
+     * @brief Generate missing pyramid layers
+     *
+     * Some vendor files store only every fourth (or coarser) layer. When enabled,
+     * intermediate 2x layers are inserted into Extent::layers wherever adjacent
+     * stored layers differ by more than a factor of two in scale. Synthesized
+     * tiles are generated on demand from the next finer layer and are cached
+     * like stored tiles (see LayerExtent::synthesized).
+     *
+     * \warning Synthesized layers are inserted between stored layers, so enabling
+     * this changes the indices of stored layers within Extent::layers. Every layer
+     * index passed to the slide (ex. SlideTileReadInfo::layer, SlideShardInfo::layer,
+     * TileKey, LayerCacheQuotas) refers to the extended list. This is disabled by
+     * default so that layer indices match the stored layers of the file.
+     */
+    bool                 synthesizeLayers = false;
+    /// @brief Filter used to generate synthesized layer tiles
+    LayerSynthesisFilter synthesisFilter = LAYER_SYNTHESIS_BOX;
+    /**
+     * @brief Optional sidecar file in which synthesized tiles are persisted
+     * between sessions. Nullptr keeps synthesized tiles in memory only.
+     *
+     * The sidecar header records the source slide's file size, modification
+     * time and a hash of its tile table, as well as the synthesis filter. A
+     * sidecar that does not match the source slide on open is stale and is
+     * ignored and overwritten rather than used.
+     *
+     * \note The path string is copied by create_slide and need not outlive that call.
+     */
+    const char*          synthesisSidecarPath = nullptr;
+    /// @brief Tile cache admission policy
+    CacheAdmission       admission      = CACHE_ADMISSION_FREQUENCY;
+    /**
+     * @brief Fraction of capacity reserved for the probationary segment (CACHE_ADMISSION_FREQUENCY)
+     *
+     * The segment must hold at least the tiles of one view, or tiles of the
+     * current view are evicted from probation before they can be credited.
+     * While the slide is open in a viewer, the segment is therefore never
+     * smaller than twice the number of tiles covering the largest bound surface
+     * (a 3840 x 2160 surface is covered by up to 16 x 10 = 160 tiles), up to
+     * half of the capacity. The fraction alone applies to slides not open in
+     * a viewer.
+     */
+    float                probationFraction = 0.05f;
+    /// @brief Number of tiles held in the streaming ring used by TILE_READ_STREAMING requests
+    uint32_t             streamingRingSize = 64;
+};
+/**
+ * @brief Runtime statistics of an Iris::Slide tile cache.
+ *
+ * Counters are cumulative from the creation of the slide. Sampling the
+ * counters at two points in time gives lookup and hit rates.
+ */
+struct SlideCacheStats {
+    /// @brief Number of tiles currently held in the cache
+    size_t               tiles          = 0;
+    /// @brief Maximum number of tiles the cache may hold (SlideOpenInfo::capacity)
+    size_t               capacity       = 0;
+    /// @brief Number of cache lookups
+    uint64_t             lookups        = 0;
+    /// @brief Number of lookups that found the tile in the cache
+    uint64_t             hits           = 0;
+    /// @brief Number of lookups that did not find the tile in the cache
+    uint64_t             misses         = 0;
+    /// @brief Number of tiles inserted into the cache
+    uint64_t             inserts        = 0;
+    /// @brief Number of tiles evicted from the cache
+    uint64_t             evictions      = 0;
+    /**
+     * @brief Number of evicted tile buffers waiting to be reclaimed
+     *
+     * The render and upload threads read cached tiles within a reclamation
+     * epoch rather than holding a reference count on each tile. An evicted
+     * tile buffer is only recycled once every reader has advanced past
+     * the epoch in which the tile was evicted.
+     *
+     * Epochs only cover the engine's internal readers. Buffers handed out through
+     * the API (read_slide_tile, Buffer_export_dlpack tensors, Patch::data) are held
+     * by Iris::Buffer references outside any epoch. An evicted buffer with such an
+     * outstanding reference is never recycled: once its epoch has passed the cache
+     * drops its own reference and the memory is freed when the last external
+     * reference is released. Its contents are never overwritten while referenced.
+     */
+    size_t               retired        = 0;
+    /// @brief Number of evicted tile buffers reclaimed and recycled for new tiles
+    /// (buffers with outstanding external references are never recycled)
+    uint64_t             recycled       = 0;
+    /// @brief Number of NUMA nodes the cache is partitioned across (1 if not partitioned)
+    uint32_t             numaNodes      = 1;
+    /// @brief Number of hits served from a partition on a different NUMA node than the requester
+    uint64_t             remoteHits     = 0;
+    /// @brief Number of misses decoded on a different NUMA node than the requester
+    uint64_t             remoteMisses   = 0;
+    /// @brief Number of file read operations issued (adjacent tiles are coalesced into one read)
+    uint64_t             readOperations = 0;
+    /// @brief Number of bytes read from the slide file
+    uint64_t             bytesRead      = 0;
+    /// @brief Number of tiles currently being read or decoded
+    size_t               inFlight       = 0;
+    /**
+     * @brief Number of requests completed from another request's read
+     *
+     * Misses are registered in an in-flight table keyed by Iris::TileKey. A
+     * request for a tile that is already being read or decoded (by a viewer,
+     * the prefetcher, or read_slide_tile) joins that entry's waiter list
+     * rather than issuing a second read and decode.
+     */
+    uint64_t             deduplicated   = 0;
+    /// @brief Number of tiles currently held in the probationary segment
+    size_t               probationary   = 0;
+    /// @brief Number of tiles promoted from the probationary segment to the main cache
+    uint64_t             promotions     = 0;
+    /// @brief Number of probationary tiles dropped without being admitted
+    uint64_t             rejections     = 0;
+    /// @brief Number of TILE_READ_STREAMING reads that bypassed the tile cache
+    uint64_t             streamingReads = 0;
+    /// @brief Number of tiles currently pinned
+    size_t               pinned         = 0;
+};
+using SlideOpenInfos    = std::vector<SlideOpenInfo>;
+/**
+ * @brief Order in which the tiles of a layer are traversed.
+ *
+ * Space filling curves (Morton / Hilbert) keep tiles that are near each
+ * other on the slide near each other within the ordering.
+ */
+enum TileOrder {
+    /// @brief The order in which the tiles are stored within the slide file.
+    /// Row-major for vendor files; the repack order for repacked files (see repack_slide).
+    TILE_ORDER_STORAGE,
+    /// @brief Row by row, left to right and top to bottom
+    TILE_ORDER_ROW_MAJOR,
+    /// @brief Morton (Z-order) curve
+    TILE_ORDER_MORTON,
+    /// @brief Hilbert curve; best locality of the available orderings
+    TILE_ORDER_HILBERT,
+};
+/**
+ * @brief Metric used to balance the tile space of a layer between shards.
+ */
+enum ShardBalance {
+    /// @brief Each shard receives an equal number of tiles
+    SHARD_BALANCE_TILE_COUNT,
+    /// @brief Each shard receives an equal area of tissue; background tiles are omitted
+    SHARD_BALANCE_TISSUE_AREA,
+};
+/**
+ * @brief Information to partition the tile space of a slide layer into shards
+ * for distributed processing.
+ *
+ * Tiles are first ordered along the requested TileOrder and the resulting
+ * sequence is cut into shardCount contiguous segments of (approximately) equal
+ * weight. With the default TILE_ORDER_STORAGE each shard is a contiguous run of
+ * the file's own tile sequence (a band of rows for row-major files) and is read
+ * with contiguous I/O. Hilbert or Morton orders produce spatially compact shards;
+ * these are only contiguous within the file when the slide was repacked in the
+ * same order (see repack_slide). On row-major files a compact shard spans one
+ * disjoint file range per tile row.
+ *
+ * \note Sharding is deterministic. The same slide file and the same
+ * SlideShardInfo will always produce the same shard on any machine, allowing
+ * a failed shard to be retried on another node.
+ */
+struct SlideShardInfo {
+    /// @brief Index of the objective layer within Extent::layers to partition
+    uint32_t            layer       = 0;
+    /// @brief Total number of shards the layer is partitioned into
+    uint32_t            shardCount  = 1;
+    /// @brief Index of the shard to return [0, shardCount)
+    uint32_t            shardIndex  = 0;
+    /// @brief Metric used to balance the shards
+    ShardBalance        balance     = SHARD_BALANCE_TISSUE_AREA;
+    /// @brief Ordering along which the tile sequence is cut into shards
+    TileOrder           order       = TILE_ORDER_STORAGE;
+};
+/**
+ * @brief Location of a tile within an objective layer.
+ */
+struct TileIndex {
+    /// @brief Horizontal tile index within the layer
+    uint32_t            xIndex      = 0;
+    /// @brief Vertical tile index within the layer
+    uint32_t            yIndex      = 0;
+};
+using TileIndices       = std::vector<TileIndex>;
+/**
+ * @brief A single shard of a slide layer's tile space
+ *
+ * The tiles are listed in the SlideShardInfo::order traversal order and
+ * should be processed in that order to keep file reads contiguous.
+ */
+struct SlideShard {
+    /// @brief Objective layer the shard was taken from
+    uint32_t            layer       = 0;
+    /// @brief Index of this shard [0, SlideShardInfo::shardCount)
+    uint32_t            shardIndex  = 0;
+    /// @brief Tiles belonging to this shard in processing order
+    TileIndices         tiles;
+    /// @brief Fraction of the layer's total tissue area contained within this shard [0,1.f]
+    float               tissue      = 0.f;
+};
+/**
+ * @brief Largest values representable within an Iris::TileKey.
+ */
+enum : uint32_t {
+    /// @brief Largest objective layer index (8 bits)
+    TILE_KEY_MAX_LAYER          = 0xFF,
+    /// @brief Largest horizontal or vertical tile index (20 bits)
+    TILE_KEY_MAX_INDEX          = 0xFFFFF,
+};
+/**
+ * @brief Canonical packed 64-bit identity of a tile within an open slide.
+ *
+ * The key packs the slide identifier (16 bits, see slide_get_id), the objective
+ * layer (8 bits) and the Morton interleaved tile x and y indices (20 bits each)
+ * into a single integer. Iris uses this key in the tile cache, the in-flight
+ * request table, the prefetcher, and statistics. Keys compare as integers and
+ * keys of the same slide layer sort in Morton order, so neighbouring tiles
+ * have neighbouring keys.
+ *
+ * \warning Layers above TILE_KEY_MAX_LAYER and tile indices above
+ * TILE_KEY_MAX_INDEX are not representable and are masked to their low bits.
+ * Iris rejects slides exceeding these limits (256 layers, or more than 2^20
+ * tiles along either dimension of a layer) when they are opened, so every tile
+ * of an open slide has a unique key.
+ */
+struct TileKey {
+    uint64_t            key         = 0;
+
+    constexpr TileKey               () = default;
+    constexpr explicit TileKey      (uint64_t packed) : key (packed) {}
+    constexpr TileKey               (uint16_t slide, uint32_t layer, uint32_t x_index, uint32_t y_index) :
+    key (uint64_t(slide) << 48 | uint64_t(layer & TILE_KEY_MAX_LAYER) << 40 |
+         spread (x_index) | spread (y_index) << 1) {}
+    /// @brief Identifier of the slide the tile belongs to
+    constexpr uint16_t slide        () const { return uint16_t (key >> 48); }
+    /// @brief Objective layer of the tile
+    constexpr uint32_t layer        () const { return uint32_t (key >> 40) & TILE_KEY_MAX_LAYER; }
+    /// @brief Horizontal tile index within the layer
+    constexpr uint32_t xIndex       () const { return compact (key); }
+    /// @brief Vertical tile index within the layer
+    constexpr uint32_t yIndex       () const { return compact (key >> 1); }
+    constexpr bool operator ==      (const TileKey& other) const { return key == other.key; }
+    constexpr bool operator !=      (const TileKey& other) const { return key != other.key; }
+    constexpr bool operator <       (const TileKey& other) const { return key <  other.key; }
+
+private:
+    static constexpr uint64_t interleave (uint64_t bits, uint32_t shift, uint64_t mask) {
+        return (bits | bits << shift) & mask;
+    }
+    static constexpr uint64_t deinterleave (uint64_t bits, uint32_t shift, uint64_t mask) {
+        return (bits | bits >> shift) & mask;
+    }
+    // Spread the low 20 bits of value into the even bits of a 40-bit word
+    static constexpr uint64_t spread (uint32_t value) {
+        return interleave (interleave (interleave (interleave (interleave (
+               value & TILE_KEY_MAX_INDEX,
+               16, 0x0000FFFF0000FFFFULL),
+                8, 0x00FF00FF00FF00FFULL),
+                4, 0x0F0F0F0F0F0F0F0FULL),
+                2, 0x3333333333333333ULL),
+                1, 0x5555555555555555ULL);
+    }
+    // Gather the even bits of the low 40-bit word back into a 20-bit value
+    static constexpr uint32_t compact (uint64_t value) {
+        return uint32_t (deinterleave (deinterleave (deinterleave (deinterleave (deinterleave (
+               value & 0x5555555555ULL,
+                1, 0x3333333333333333ULL),
+                2, 0x0F0F0F0F0F0F0F0FULL),
+                4, 0x00FF00FF00FF00FFULL),
+                8, 0x0000FFFF0000FFFFULL),
+               16, 0x00000000FFFFFFFFULL));
+    }
+};
+using TileKeys          = std::vector<TileKey>;
+/**
+ * @brief Access pattern hint attached to a tile read request.
+ */
+enum TileReadHint {
+    /// @brief Interactive access; the tile is cached in the slide tile cache
+    TILE_READ_DEFAULT,
+    /**
+     * @brief Sequential, read-once access such as a whole slide sweep. The tile
+     * bypasses the slide tile cache and is held only in a small streaming ring
+     * of its own (see SlideOpenInfo::streamingRingSize), so a batch job does not
+     * evict the tiles of an interactive viewer sharing the same slide.
+     * Tiles already present in the cache are copied from it rather than re-read;
+     * such a hit does not refresh the tile's recency nor increment its count in
+     * the admission frequency sketch (see CACHE_ADMISSION_FREQUENCY), so a sweep
+     * never changes which tiles the cache retains.
+     * The returned buffer is always owned solely by the caller.
+     */
+    TILE_READ_STREAMING,
+};
+/**
+ * @brief Information to read a single decoded tile from an Iris::Slide.
+ *
+ * Tiles are addressed by objective layer and tile index within that layer
+ * (see LayerExtent for the number of 256 pixel tiles in each dimension).
+ */
+struct SlideTileReadInfo {
+    /// @brief Index of the objective layer within Extent::layers
+    uint32_t            layer       = 0;
+    /// @brief Horizontal tile index within the layer
+    uint32_t            xIndex      = 0;
+    /// @brief Vertical tile index within the layer
+    uint32_t            yIndex      = 0;
+    /// @brief Pixel Format of the returned tile data
+    Format              format      = FORMAT_R8G8B8A8;
+    /// @brief Access pattern of the request
+    TileReadHint        hint        = TILE_READ_DEFAULT;
+    /// @brief Scan order followed by the caller, used for read-ahead
+    TileOrder           order       = TILE_ORDER_STORAGE;
+    /// @brief Number of tiles following this one along order to read ahead in the background
+    uint32_t            readAhead   = 0;
+};
+/**
+ * @brief Share of the slide tile cache assigned to a single objective layer.
+ *
+ * Shares are fractions of the whole SlideOpenInfo::capacity, including when the
+ * cache is partitioned per NUMA node (see SlideOpenInfo::numaPartitioned).
+ * The minimum is reserved for
+ * the layer and its tiles are never evicted to make room for other layers while
+ * the layer is under its minimum. The reservation is clamped to the number of
+ * tiles in the layer: a layer reserves min (minimum x capacity, xTiles x yTiles)
+ * tiles. A minimum of 1.f therefore keeps an entire coarse layer resident while
+ * reserving only that layer's tiles, and several layers may each use 1.f as long
+ * as their clamped reservations fit within the capacity together.
+ * The maximum caps the layer: once reached, the layer evicts its own tiles.
+ *
+ * Pinned tiles (see slide_pin_tiles) count toward their layer's share. A pin may
+ * take a layer beyond its maximum; while it is over, the layer's unpinned tiles
+ * are evicted first and new unpinned tiles of that layer are not cached beyond
+ * the maximum. The excess pinned tiles are taken from the capacity that is not
+ * reserved by other layers' minimums.
+ */
+struct LayerCacheQuota {
+    /// @brief Minimum share of the cache capacity reserved for the layer [0,1.f]
+    float               minimum     = 0.f;
+    /// @brief Maximum share of the cache capacity the layer may occupy [0,1.f]
+    float               maximum     = 1.f;
+};
+/// @brief Per-layer cache quotas, indexed in the same order as Extent::layers
+using LayerCacheQuotas  = std::vector<LayerCacheQuota>;
+/**
+ * @brief Rectangular region of tiles to pin within a slide layer.
+ *
+ * Pinned tiles count against SlideOpenInfo::capacity.
+ */
+struct SlidePinInfo {
+    /// @brief Index of the objective layer within Extent::layers
+    uint32_t            layer       = 0;
+    /// @brief Horizontal index of the first (left) tile of the region
+    uint32_t            xIndex      = 0;
+    /// @brief Vertical index of the first (top) tile of the region
+    uint32_t            yIndex      = 0;
+    /// @brief Number of horizontal tiles in the region
+    uint32_t            xTiles      = 1;
+    /// @brief Number of vertical tiles in the region
+    uint32_t            yTiles      = 1;
+    /// @brief Also pin the tiles of coarser layers covering the region
+    bool                coarser     = false;
+};
+/**
+ * @brief Parameters required to create an Iris::PatchSampler engine.
+ *
+ * The sampler draws patch locations uniformly at random across the
+ * provided slide list and shuffles requests between slides. Only
+ * openSlidesLimit slides are mapped at any one time; the remaining
+ * slides are opened on demand as mapped slides are rotated out.
+ * Pending requests are grouped by slide and sorted by file location
+ * before being dispatched so that each batch reads from a few
+ * neighbouring regions of the file rather than random offsets.
+ *
+ * \note The sampler is deterministic for a given seed and slide list.
+ * \note The file path and slide ID strings within slides are copied by
+ * Iris::create_patch_sampler. They need only remain valid for that call even
+ * though slides are opened and closed for the lifetime of the sampler.
+ */
+struct PatchSamplerCreateInfo {
+    /// @brief List of slide files from which patches are drawn (strings are copied at creation)
+    SlideOpenInfos      slides;
+    /// @brief Maximum number of slides mapped at the same time (bounded file handles)
+    uint32_t            openSlidesLimit = 32;
+    /**
+     * @brief Index of the objective layer (within Extent::layers) to sample from
+     *
+     * \warning The same index is applied to every slide. Slides from different
+     * scanners have different pyramids, so a fixed index samples different
+     * magnifications across the slide list. Prefer targetDownsample for
+     * heterogeneous slide lists.
+     */
+    uint32_t            layer           = 0;
+    /**
+     * @brief Target downsample relative to each slide's highest power layer
+     *
+     * When greater than zero, this replaces layer: each slide samples from its
+     * layer whose LayerExtent::downsample is nearest (in log scale) to the target.
+     * The layer actually used is reported by Patch::layer and Patch::downsample.
+     */
+    float               targetDownsample = 0.f;
+    /// @brief Number of horizontal pixels in each returned patch
+    uint32_t            patchWidth      = 256;
+    /// @brief Number of vertical pixels in each returned patch
+    uint32_t            patchHeight     = 256;
+    /// @brief Pixel Format of returned patch data
+    Format              format          = FORMAT_R8G8B8;
+    /// @brief Reject patch locations that do not contain tissue
+    bool                tissueOnly      = false;
+    /// @brief Minimum fraction of tissue pixels [0,1.f] for a tissue-only patch to be accepted
+    float               tissueThreshold = 0.5f;
+    /// @brief Number of patches grouped together and sorted by file location per read batch
+    uint32_t            batchSize       = 64;
+    /// @brief Number of patches to prepare ahead of the calling data loader
+    uint32_t            queueDepth      = 1024;
+    /// @brief Random seed used for patch locations and slide shuffling
+    uint64_t            seed            = 0;
+};
+/**
+ * @brief A single sampled patch returned from an Iris::PatchSampler
+ *
+ * The data buffer contains patchWidth x patchHeight pixels in the requested
+ * Format, tightly packed in rows. The location is given in pixels of the
+ * sampled layer relative to the top left corner of the layer.
+ */
+struct Patch {
+    /// @brief Patch pixel data in the sampler's requested format
+    Buffer              data;
+    /// @brief Index into PatchSamplerCreateInfo::slides of the source slide
+    uint32_t            slide       = 0;
+    /// @brief Objective layer the patch was sampled from
+    uint32_t            layer       = 0;
+    /// @brief LayerExtent::downsample of the layer the patch was sampled from
+    float               downsample  = 1.f;
+    /// @brief Horizontal pixel offset of the patch within the layer
+    uint32_t            x           = 0;
+    /// @brief Vertical pixel offset of the patch within the layer
+    uint32_t            y           = 0;
+    /// @brief Number of horizontal pixels in the patch
+    uint32_t            width       = 0;
+    /// @brief Number of vertical pixels in the patch
+    uint32_t            height      = 0;
+    /// @brief Fraction of pixels within the patch identified as tissue [0,1.f]
+    float               tissue      = 0.f;
+};
+using Patches           = std::vector<Patch>;
+/**
+ * @brief Parameters required to rewrite a slide file with a locality preserving tile order.
+ *
+ * Tiles stored row by row cause a square viewport to span many disjoint file
+ * ranges. Repacking writes an Iris Codec file whose tiles are stored along a
+ * space filling curve within each layer so that a viewport reads a few
+ * contiguous runs. With interleaveLayers, each coarse layer tile is written
+ * immediately before the finer tiles it covers.
+ */
+struct SlideRepackInfo {
+    /// @brief Source slide to repack
+    Slide               slide;
+    /// @brief Output Iris Codec file path
+    const char*         filePath            = nullptr;
+    /// @brief Tile storage order within each layer (TILE_ORDER_STORAGE is not valid here)
+    TileOrder           order               = TILE_ORDER_HILBERT;
+    /// @brief Store coarse layer tiles near the finer layer tiles they cover
+    bool                interleaveLayers    = true;
+};
+/**
+ * @brief Destination file structure for a slide export.
+ */
+enum SlideExportFormat {
+    SLIDE_EXPORT_UNDEFINED,
+    /// @brief Tiled, pyramidal BigTIFF file with one image file directory per layer
+    SLIDE_EXPORT_PYRAMIDAL_TIFF,
+    /**
+     * @brief DeepZoom (DZI) descriptor and tile folder hierarchy
+     *
+     * DeepZoom requires a level for every power of two down to a single pixel.
+     * Levels that coincide with a stored layer reuse that layer's tiles. Every
+     * other level is generated by the exporter during the export by 2x box
+     * downsampling of the next finer level it has written, regardless of
+     * SlideOpenInfo::synthesizeLayers. Levels below the lowest power stored
+     * layer are likewise generated down to 1x1.
+     *
+     * DeepZoom tiles are always written with a TileSize of 256 and an Overlap
+     * of 0, matching the Iris tile grid, so stored tiles map one to one onto
+     * DeepZoom tiles.
+     */
+    SLIDE_EXPORT_DEEP_ZOOM,
+};
+/**
+ * @brief Image encoding of tiles written by a slide export.
+ */
+enum SlideExportEncoding {
+    SLIDE_EXPORT_ENCODING_JPEG,
+    SLIDE_EXPORT_ENCODING_PNG,
+};
+/**
+ * @brief Parameters required to export a slide for use by external viewers.
+ *
+ * When the source is an Iris Codec file, tiles whose stored encoding matches the
+ * requested encoding (and quality, when the source quality is known) are copied
+ * directly from the source file without being decoded; Iris Codec stores each
+ * tile as a self-contained image. Tiles from other vendor formats (which may
+ * rely on shared JPEG tables or use a tile size other than 256) are never
+ * copied. All other tiles are decoded and re-encoded in parallel on
+ * encodeThreads threads. The exporter streams the slide layer by layer and
+ * holds no more than memoryLimit bytes of tile data in flight, so memory use is
+ * independent of the slide dimensions.
+ */
+struct SlideExportInfo {
+    /// @brief Source slide to export
+    Slide               slide;
+    /// @brief Output path. The TIFF file path or the DZI descriptor path (tile folder is placed beside it)
+    const char*         filePath        = nullptr;
+    /// @brief Output file structure
+    SlideExportFormat   format          = SLIDE_EXPORT_UNDEFINED;
+    /// @brief Output tile encoding
+    SlideExportEncoding encoding        = SLIDE_EXPORT_ENCODING_JPEG;
+    /// @brief Encoding quality [1,100] used when tiles must be re-encoded with a lossy encoding
+    uint8_t             quality         = 90;
+    /// @brief Number of encoding threads. Zero will use the available hardware concurrency
+    uint32_t            encodeThreads   = 0;
+    /// @brief Upper bound, in bytes, of tile data held in memory during the export
+    size_t              memoryLimit     = 256ULL << 20;
+};
+/**
+ * @brief Results reported on completion of a slide export.
+ */
+struct SlideExportResults {
+    /// @brief Total number of tiles written to the output
+    uint64_t            tilesWritten    = 0;
+    /// @brief Number of tiles copied from the source without decoding (Iris Codec sources only)
+    uint64_t            tilesCopied     = 0;
+    /// @brief Number of tiles decoded and re-encoded
+    uint64_t            tilesEncoded    = 0;
+    /// @brief Wall clock duration of the export in seconds
+    double              seconds         = 0.0;
+    /// @brief Export throughput in tiles per second (tilesWritten / seconds)
+    double              tilesPerSecond  = 0.0;
+};
+/**
+ * @brief Tile protocols served by an Iris::TileServer. Values may be combined.
+ */
+enum TileServerProtocol : uint32_t {
+    /// @brief IIIF Image API (info.json and /{region}/{size}/{rotation}/{quality}.{format} requests)
+    TILE_SERVER_PROTOCOL_IIIF       = 0x00000001,
+    /// @brief DeepZoom descriptor (.dzi) and _files/{level}/{col}_{row}.{format} requests
+    TILE_SERVER_PROTOCOL_DEEP_ZOOM  = 0x00000002,
+};
+/**
+ * @brief Parameters required to create an Iris::TileServer.
+ *
+ * Passthrough applies only to slides whose stored tiles are self-contained
+ * encoded images, which is the case for Iris Codec files. For those slides,
+ * requests that map exactly onto a stored tile in its stored encoding are answered
+ * by sending the encoded bytes straight from the mapped slide file (sendfile where
+ * the platform supports it) without decoding.
+ *
+ * Vendor files opened through OpenSlide (ex. SVS with shared JPEGTables) store
+ * tiles that are not standalone images. For these slides every request is
+ * decoded through the slide's tile cache and re-encoded. The same applies on any
+ * slide to requests that require resampling, cropping, or a different encoding.
+ */
+struct TileServerCreateInfo {
+    /// @brief Slide to serve
+    Slide               slide;
+    /// @brief Interface address to bind (ex. "127.0.0.1")
+    const char*         address     = "127.0.0.1";
+    /// @brief Port to listen on. Zero will select an available port
+    uint16_t            port        = 0;
+    /// @brief Combination of TileServerProtocol flags to serve
+    uint32_t            protocols   = TILE_SERVER_PROTOCOL_IIIF | TILE_SERVER_PROTOCOL_DEEP_ZOOM;
+    /// @brief Number of connection threads. Zero will use the available hardware concurrency
+    uint32_t            threads     = 0;
+};
+/**
+ * @brief Runtime statistics of an Iris::TileServer.
+ */
+struct TileServerStats {
+    /// @brief Port the server is listening on
+    uint16_t            port        = 0;
+    /// @brief Total number of tile requests answered
+    uint64_t            requests    = 0;
+    /// @brief Requests answered with the stored encoded tile bytes (no decode; Iris Codec files only)
+    uint64_t            passthrough = 0;
+    /// @brief Requests that required decoding and re-encoding
+    uint64_t            encoded     = 0;
+    /// @brief Total number of response body bytes sent
+    uint64_t            bytesSent   = 0;
 };
 using LambdaPtr         = std::function<void()>;
 using LambdaPtrs        = std::vector<LambdaPtr>;
 } // END IRIS NAMESPACE
+/**
+ * @brief Hash of an Iris::TileKey for use in unordered containers.
+ *
+ * The packed key is already unique; a single multiplicative (Fibonacci) mix
+ * spreads the Morton bits across the hash so power-of-two tables stay balanced.
+ */
+namespace std {
+template <>
+struct hash<Iris::TileKey> {
+    size_t operator () (const Iris::TileKey& tile) const noexcept {
+        return size_t ((tile.key * 0x9E3779B97F4A7C15ULL) >> 16 ^ tile.key);
+    }
+};
+} // END STD NAMESPACE
 
 #endif /* IrisTypes_h */